@@ -97,6 +97,7 @@ public:
    gzstreambuf* close();
    virtual int     overflow( int c = EOF );
    virtual int     underflow();
+   virtual std::streamsize xsgetn( char* s, std::streamsize n);
    virtual int     sync();
 };
 